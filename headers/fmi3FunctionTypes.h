@@ -291,6 +291,19 @@ typedef fmi3Status fmi3SetBinaryTYPE (fmi3Instance instance,
                                       const size_t sizes[], const fmi3Binary values[], size_t nValues);
 /* end::Setters[] */
 
+/* Getting changed variables */
+
+/* tag::GetNumberOfChangedVariables[] */
+typedef fmi3Status fmi3GetNumberOfChangedVariablesTYPE(fmi3Instance instance,
+                                                       size_t* nChangedVariables);
+/* end::GetNumberOfChangedVariables[] */
+
+/* tag::GetChangedVariables[] */
+typedef fmi3Status fmi3GetChangedVariablesTYPE(fmi3Instance instance,
+                                               fmi3ValueReference valueReferences[],
+                                               size_t nValueReferences);
+/* end::GetChangedVariables[] */
+
 /* Getting Variable Dependency Information */
 
 /* tag::GetNumberOfVariableDependencies[] */
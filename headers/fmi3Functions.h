@@ -133,6 +133,8 @@ Common Functions
 #define fmi3SetBoolean               fmi3FullName(fmi3SetBoolean)
 #define fmi3SetString                fmi3FullName(fmi3SetString)
 #define fmi3SetBinary                fmi3FullName(fmi3SetBinary)
+#define fmi3GetNumberOfChangedVariables fmi3FullName(fmi3GetNumberOfChangedVariables)
+#define fmi3GetChangedVariables      fmi3FullName(fmi3GetChangedVariables)
 #define fmi3GetNumberOfVariableDependencies fmi3FullName(fmi3GetNumberOfVariableDependencies)
 #define fmi3GetVariableDependencies  fmi3FullName(fmi3GetVariableDependencies)
 #define fmi3GetFMUState              fmi3FullName(fmi3GetFMUState)
@@ -225,6 +227,10 @@ FMI3_Export fmi3SetBinaryTYPE  fmi3SetBinary;
 FMI3_Export fmi3SetStringTYPE  fmi3SetString;
 FMI3_Export fmi3SetBinaryTYPE  fmi3SetBinary;
 
+/* Getting changed variables */
+FMI3_Export fmi3GetNumberOfChangedVariablesTYPE fmi3GetNumberOfChangedVariables;
+FMI3_Export fmi3GetChangedVariablesTYPE         fmi3GetChangedVariables;
+
 /* Getting Variable Dependency Information */
 FMI3_Export fmi3GetNumberOfVariableDependenciesTYPE fmi3GetNumberOfVariableDependencies;
 FMI3_Export fmi3GetVariableDependenciesTYPE         fmi3GetVariableDependencies;